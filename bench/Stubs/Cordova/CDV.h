@@ -0,0 +1,70 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017 Tertium Technology.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ Minimal Cordova stand-in used by the TxRx benchmarks to build TxrxPlugin outside a Cordova application. NOT shipped with the plugin
+ */
+
+#import <Foundation/Foundation.h>
+
+typedef NS_ENUM(NSUInteger, CDVCommandStatus)
+{
+    CDVCommandStatus_NO_RESULT = 0
+    ,CDVCommandStatus_OK = 1
+    ,CDVCommandStatus_ERROR = 9
+};
+
+@interface CDVPluginResult : NSObject
+
+@property (nonatomic, strong, readonly) NSNumber *status;
+@property (nonatomic, strong, readonly) id message;
+@property (nonatomic, strong) NSNumber *keepCallback;
+
++(CDVPluginResult *)resultWithStatus:(CDVCommandStatus)statusOrdinal;
++(CDVPluginResult *)resultWithStatus:(CDVCommandStatus)statusOrdinal messageAsString:(NSString *)theMessage;
++(CDVPluginResult *)resultWithStatus:(CDVCommandStatus)statusOrdinal messageAsDictionary:(NSDictionary *)theMessage;
++(CDVPluginResult *)resultWithStatus:(CDVCommandStatus)statusOrdinal messageAsBool:(BOOL)theMessage;
+-(void)setKeepCallbackAsBool:(BOOL)bKeepCallback;
+-(NSString *)argumentsAsJSON;
+
+@end
+
+@protocol CDVCommandDelegate <NSObject>
+-(void)sendPluginResult:(CDVPluginResult *)result callbackId:(NSString *)callbackId;
+@end
+
+@interface CDVInvokedUrlCommand : NSObject
+
+@property (nonatomic, strong, readonly) NSArray *arguments;
+@property (nonatomic, strong, readonly) NSString *callbackId;
+
+@end
+
+@interface CDVPlugin : NSObject
+
+@property (nonatomic, strong) id<CDVCommandDelegate> commandDelegate;
+
+-(void)pluginInitialize;
+
+@end
@@ -0,0 +1,91 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017 Tertium Technology.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#import "CDV.h"
+
+@interface CDVPluginResult ()
+@property (nonatomic, strong, readwrite) NSNumber *status;
+@property (nonatomic, strong, readwrite) id message;
+@end
+
+@implementation CDVPluginResult
+
++(CDVPluginResult *)resultWithStatus:(CDVCommandStatus)statusOrdinal message:(id)theMessage
+{
+    CDVPluginResult *result = [CDVPluginResult new];
+    
+    result.status = @(statusOrdinal);
+    result.message = theMessage;
+    result.keepCallback = @NO;
+    return result;
+}
+
++(CDVPluginResult *)resultWithStatus:(CDVCommandStatus)statusOrdinal
+{
+    return [self resultWithStatus: statusOrdinal message: nil];
+}
+
++(CDVPluginResult *)resultWithStatus:(CDVCommandStatus)statusOrdinal messageAsString:(NSString *)theMessage
+{
+    return [self resultWithStatus: statusOrdinal message: theMessage];
+}
+
++(CDVPluginResult *)resultWithStatus:(CDVCommandStatus)statusOrdinal messageAsDictionary:(NSDictionary *)theMessage
+{
+    return [self resultWithStatus: statusOrdinal message: theMessage];
+}
+
++(CDVPluginResult *)resultWithStatus:(CDVCommandStatus)statusOrdinal messageAsBool:(BOOL)theMessage
+{
+    return [self resultWithStatus: statusOrdinal message: @(theMessage)];
+}
+
+-(void)setKeepCallbackAsBool:(BOOL)bKeepCallback
+{
+    self.keepCallback = @(bKeepCallback);
+}
+
+/**
+ Encodes the message the way Cordova does before handing it to the JavaScript bridge
+ */
+-(NSString *)argumentsAsJSON
+{
+    NSData *json;
+    
+    json = [NSJSONSerialization dataWithJSONObject: @[_message ? _message : [NSNull null]] options: 0 error: nil];
+    return [[NSString alloc] initWithData: json encoding: NSUTF8StringEncoding];
+}
+
+@end
+
+@implementation CDVInvokedUrlCommand
+@end
+
+@implementation CDVPlugin
+
+-(void)pluginInitialize
+{
+}
+
+@end
@@ -0,0 +1,423 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017 Tertium Technology.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#import <Foundation/Foundation.h>
+#import <CoreBluetooth/CoreBluetooth.h>
+#import <mach/mach_time.h>
+#import "TxRxManager.h"
+#import "TxRxManagerPhases.h"
+#import "TxRxDeviceManagerExchangeProtocol.h"
+#import "TxrxPlugin.h"
+
+/**
+ TxRx benchmarks
+ 
+ Drives TxRxManager and TxrxPlugin hot paths with synthetic payloads and device counts, without bluetooth hardware: CoreBluetooth peripherals and characteristics are replaced by stubs
+ 
+ Every benchmark reports ns/op, allocations/op and bytes allocated/op and is compared against bench/baseline.json. Exit code is 1 when any value exceeds its baseline by more than the baseline tolerance
+ 
+ Usage: txrxbench [--baseline path] [--record]
+ */
+
+// libmalloc hook called on every allocation when set, the same used by malloc stack logging
+typedef void (malloc_logger_t)(uint32_t type, uintptr_t arg1, uintptr_t arg2, uintptr_t arg3, uintptr_t result, uint32_t num_hot_frames_to_skip);
+extern malloc_logger_t *malloc_logger;
+
+#define TXRX_BENCH_LOG_TYPE_ALLOCATE 2
+#define TXRX_BENCH_LOG_TYPE_DEALLOCATE 4
+
+#define TXRX_BENCH_DEFAULT_TOLERANCE 0.25
+#define TXRX_BENCH_PACKET_SIZE 20
+
+#define S_TXRX_BENCH_NS_PER_OP @"nsPerOp"
+#define S_TXRX_BENCH_ALLOCATIONS_PER_OP @"allocationsPerOp"
+#define S_TXRX_BENCH_BYTES_ALLOCATED_PER_OP @"bytesAllocatedPerOp"
+
+// TxRxManager tracking array, defined in TxRxManager.m
+extern NSMutableArray *_connectedDevices;
+
+// TxRxManager private methods driven by the benchmarks
+@interface TxRxManager (Benchmarks)
+-(void)deviceSendDataPiece: (TxRxDevice *_Nonnull) device;
+-(bool)isTerminatorOK: (TxRxDevice *_Nonnull) device forText: (NSString *_Nonnull) text;
+-(TxRxDevice *) deviceFromConnectedPeripheral: (CBPeripheral*_Nonnull) peripheral;
+@end
+
+#pragma mark CoreBluetooth and Cordova stubs
+
+/**
+ Stands in for CBPeripheral. Writes are accepted and dropped
+ */
+@interface TxRxBenchPeripheral : NSObject
+-(void)writeValue:(NSData *)data forCharacteristic:(id)characteristic type:(CBCharacteristicWriteType)type;
+@end
+
+@implementation TxRxBenchPeripheral
+-(void)writeValue:(NSData *)data forCharacteristic:(id)characteristic type:(CBCharacteristicWriteType)type
+{
+}
+@end
+
+/**
+ Stands in for CBCharacteristic. Holds the value of the last notification
+ */
+@interface TxRxBenchCharacteristic : NSObject
+@property (nonatomic, strong) NSData *value;
+@end
+
+@implementation TxRxBenchCharacteristic
+@end
+
+/**
+ Stands in for Cordova command delegate. Encodes results as Cordova does before the JavaScript bridge
+ */
+@interface TxRxBenchCommandDelegate : NSObject<CDVCommandDelegate>
+@end
+
+@implementation TxRxBenchCommandDelegate
+-(void)sendPluginResult:(CDVPluginResult *)result callbackId:(NSString *)callbackId
+{
+    [result argumentsAsJSON];
+}
+@end
+
+#pragma mark Measurement
+
+static volatile bool _counting;
+static uint64_t _allocations;
+static uint64_t _bytesAllocated;
+
+/**
+ Counts allocations while a benchmark runs. Reallocations count as an allocation of the new size
+ */
+static void txRxBenchMallocLogger(uint32_t type, uintptr_t arg1, uintptr_t arg2, uintptr_t arg3, uintptr_t result, uint32_t num_hot_frames_to_skip)
+{
+    if (!_counting || !(type & TXRX_BENCH_LOG_TYPE_ALLOCATE))
+        return;
+    
+    _allocations++;
+    _bytesAllocated += (type & TXRX_BENCH_LOG_TYPE_DEALLOCATE) ? arg3 : arg2;
+}
+
+/**
+ Runs operation a number of times and returns its per operation costs
+ 
+ @param operations - Number of measured runs, preceded by a tenth of warm up runs
+ @param operation - The operation to measure
+ @return - Dictionary with S_TXRX_BENCH_ metrics
+ */
+static NSDictionary *txRxBenchMeasure(NSUInteger operations, void (^operation)(void))
+{
+    static mach_timebase_info_data_t timeBase;
+    uint64_t start, elapsed;
+    
+    if (timeBase.denom == 0)
+        mach_timebase_info(&timeBase);
+    
+    @autoreleasepool {
+        for (NSUInteger i = 0; i < operations / 10; i++)
+            operation();
+    }
+    
+    _allocations = 0;
+    _bytesAllocated = 0;
+    _counting = true;
+    start = mach_absolute_time();
+    @autoreleasepool {
+        for (NSUInteger i = 0; i < operations; i++)
+            operation();
+    }
+    elapsed = (mach_absolute_time() - start) * timeBase.numer / timeBase.denom;
+    _counting = false;
+    
+    return @{
+             S_TXRX_BENCH_NS_PER_OP: @((double) elapsed / operations),
+             S_TXRX_BENCH_ALLOCATIONS_PER_OP: @((double) _allocations / operations),
+             S_TXRX_BENCH_BYTES_ALLOCATED_PER_OP: @((double) _bytesAllocated / operations)
+             };
+}
+
+#pragma mark Fixtures
+
+/**
+ Returns a payload of printable bytes
+ */
+static NSData *txRxBenchPayload(NSUInteger size)
+{
+    NSMutableData *payload = [NSMutableData dataWithLength: size];
+    uint8_t *bytes = payload.mutableBytes;
+    
+    for (NSUInteger i = 0; i < size; i++)
+        bytes[i] = 'A' + i % 26;
+    
+    return payload;
+}
+
+/**
+ Returns a connected TxRxDevice bound to stub peripheral and characteristics
+ */
+static TxRxDevice *txRxBenchDevice(NSUInteger index)
+{
+    TxRxDevice *device = [TxRxDevice new];
+    NSObject<TxRxDeviceManagerExchangeProtocol> *hiddenDevice = (NSObject<TxRxDeviceManagerExchangeProtocol> *) device;
+    
+    device.Name = @"Bench device";
+    device.IndexedName = [NSString stringWithFormat: @"Bench device_%lu", (unsigned long) index];
+    device.cbPeripheral = (CBPeripheral *) [TxRxBenchPeripheral new];
+    device.rxChar = (CBCharacteristic *) [TxRxBenchCharacteristic new];
+    device.txChar = (CBCharacteristic *) [TxRxBenchCharacteristic new];
+    device.deviceProfile = [TxRxDeviceProfile newProfileWithParameters: @"175f8f23-a570-49bd-9627-815a6a27de2a"
+                                                            withRxUUID: @"1cce1ea8-bd34-4813-a00a-c76e028fadcb"
+                                                            withTxUUID: @"cacc07ff-ffff-4c48-8fae-a9ef71b75e26"
+                                                        withCommandEnd: @"\r\n"
+                                                     withMaxPacketSize: TXRX_BENCH_PACKET_SIZE];
+    hiddenDevice.deviceConnected = true;
+    
+    return device;
+}
+
+/**
+ Returns the manager without initializing CoreBluetooth, benchmarks never reach the central manager
+ */
+static TxRxManager *txRxBenchManager(void)
+{
+    TxRxManager *manager = [TxRxManager alloc];
+    
+    manager.callbackQueue = dispatch_get_main_queue();
+    manager.dispatchQueue = dispatch_get_main_queue();
+    [manager setTimeOutDefaults];
+    _connectedDevices = [NSMutableArray new];
+    
+    return manager;
+}
+
+#pragma mark Benchmarks
+
+/**
+ deviceSendDataPiece: slicing a whole command in packets. One op is one payload
+ */
+static void txRxBenchSendDataPiece(TxRxManager *manager, NSMutableDictionary *results)
+{
+    for (NSNumber *size in @[@16, @256, @4096]) {
+        TxRxDevice *device = txRxBenchDevice(0);
+        NSObject<TxRxDeviceManagerExchangeProtocol> *hiddenDevice = (NSObject<TxRxDeviceManagerExchangeProtocol> *) device;
+        NSData *payload = txRxBenchPayload(size.unsignedIntegerValue);
+        
+        [_connectedDevices removeAllObjects];
+        [_connectedDevices addObject: device];
+        
+        results[[NSString stringWithFormat: @"deviceSendDataPiece/payload=%@", size]] = txRxBenchMeasure(1000, ^{
+            hiddenDevice.dataToSend = payload;
+            hiddenDevice.sendingData = true;
+            [manager deviceSendDataPiece: device];
+            while (hiddenDevice.sendingData) {
+                // As acknowledged by peripheral:didWriteValueForCharacteristic:error:
+                hiddenDevice.totalBytesSent += hiddenDevice.bytesSent;
+                [manager deviceSendDataPiece: device];
+            }
+        });
+        
+        [hiddenDevice invalidateWatchDogTimer];
+    }
+}
+
+/**
+ peripheral:didUpdateValueForCharacteristic:error: receiving a whole answer in notifications. One op is one payload
+ */
+static void txRxBenchReceiveAppend(TxRxManager *manager, NSMutableDictionary *results)
+{
+    for (NSNumber *size in @[@16, @256, @4096]) {
+        TxRxDevice *device = txRxBenchDevice(0);
+        NSObject<TxRxDeviceManagerExchangeProtocol> *hiddenDevice = (NSObject<TxRxDeviceManagerExchangeProtocol> *) device;
+        TxRxBenchCharacteristic *txChar = (TxRxBenchCharacteristic *) device.txChar;
+        NSData *payload = txRxBenchPayload(size.unsignedIntegerValue);
+        NSMutableArray *packets = [NSMutableArray new];
+        
+        for (NSUInteger offset = 0; offset < payload.length; offset += TXRX_BENCH_PACKET_SIZE)
+            [packets addObject: [payload subdataWithRange: NSMakeRange(offset, MIN(TXRX_BENCH_PACKET_SIZE, payload.length - offset))]];
+        
+        [_connectedDevices removeAllObjects];
+        [_connectedDevices addObject: device];
+        
+        // Answer to an issued command, receive watchdog is running
+        [hiddenDevice scheduleWatchdogWithParameters: TERTIUM_PHASE_RECEIVING_DATA withInterval: 3600.0 target: manager selector: NSSelectorFromString(@"watchDogTimerTickReceivingData:ManagesDevice:inPhase:")];
+        
+        results[[NSString stringWithFormat: @"receiveAppend/payload=%@", size]] = txRxBenchMeasure(1000, ^{
+            for (NSData *packet in packets) {
+                txChar.value = packet;
+                [manager peripheral: (CBPeripheral *) device.cbPeripheral didUpdateValueForCharacteristic: (CBCharacteristic *) txChar error: nil];
+            }
+            [hiddenDevice resetReceivedData];
+        });
+        
+        [hiddenDevice invalidateWatchDogTimer];
+    }
+}
+
+/**
+ isTerminatorOK:forText: on a received answer, including its string conversion as done by the receive watchdog
+ */
+static void txRxBenchTerminatorCheck(TxRxManager *manager, NSMutableDictionary *results)
+{
+    for (NSNumber *size in @[@16, @256, @4096]) {
+        TxRxDevice *device = txRxBenchDevice(0);
+        NSObject<TxRxDeviceManagerExchangeProtocol> *hiddenDevice = (NSObject<TxRxDeviceManagerExchangeProtocol> *) device;
+        
+        [hiddenDevice.receivedData appendData: txRxBenchPayload(size.unsignedIntegerValue)];
+        [hiddenDevice.receivedData appendData: [@"\r\n" dataUsingEncoding: NSASCIIStringEncoding]];
+        
+        results[[NSString stringWithFormat: @"terminatorCheck/payload=%@", size]] = txRxBenchMeasure(10000, ^{
+            NSString *text = [[NSString alloc] initWithData: hiddenDevice.receivedData encoding: NSASCIIStringEncoding];
+            [manager isTerminatorOK: device forText: text];
+        });
+    }
+}
+
+/**
+ deviceFromConnectedPeripheral: lookup of the last connected device
+ */
+static void txRxBenchDeviceLookup(TxRxManager *manager, NSMutableDictionary *results)
+{
+    for (NSNumber *count in @[@1, @16, @256]) {
+        [_connectedDevices removeAllObjects];
+        for (NSUInteger i = 0; i < count.unsignedIntegerValue; i++)
+            [_connectedDevices addObject: txRxBenchDevice(i)];
+        
+        CBPeripheral *peripheral = ((TxRxDevice *) _connectedDevices.lastObject).cbPeripheral;
+        results[[NSString stringWithFormat: @"deviceLookup/devices=%@", count]] = txRxBenchMeasure(100000, ^{
+            [manager deviceFromConnectedPeripheral: peripheral];
+        });
+    }
+}
+
+/**
+ TxrxPlugin callbacks building their JavaScript messages
+ */
+static void txRxBenchPluginCallbacks(TxRxManager *manager, NSMutableDictionary *results)
+{
+    TxrxPlugin *plugin = [TxrxPlugin new];
+    TxRxDevice *device = txRxBenchDevice(0);
+    
+    // Cordova calls pluginInitialize, which would bring up CoreBluetooth. Set up what callbacks need instead
+    plugin.commandDelegate = [TxRxBenchCommandDelegate new];
+    [plugin setValue: manager forKey: @"_manager"];
+    [plugin setValue: [@{@"onDeviceFound": @"callback0", @"onNotifyData": @"callback1"} mutableCopy] forKey: @"_jsCallbacks"];
+    
+    results[@"pluginDeviceFound"] = txRxBenchMeasure(10000, ^{
+        [plugin deviceFound: device];
+    });
+    
+    for (NSNumber *size in @[@16, @256, @4096]) {
+        NSData *payload = txRxBenchPayload(size.unsignedIntegerValue);
+        
+        results[[NSString stringWithFormat: @"pluginReceivedData/payload=%@", size]] = txRxBenchMeasure(10000, ^{
+            [plugin receivedData: device withData: payload];
+        });
+    }
+}
+
+#pragma mark Baseline
+
+/**
+ Prints results and compares them against the baseline
+ 
+ @return - The number of values exceeding their baseline by more than tolerance
+ */
+static NSUInteger txRxBenchCompare(NSDictionary *results, NSDictionary *baseline)
+{
+    NSDictionary *baselineBenchmarks = baseline[@"benchmarks"];
+    double tolerance = baseline[@"tolerance"] ? [baseline[@"tolerance"] doubleValue] : TXRX_BENCH_DEFAULT_TOLERANCE;
+    NSUInteger regressions = 0;
+    
+    for (NSString *name in [results.allKeys sortedArrayUsingSelector: @selector(compare:)]) {
+        NSDictionary *measured = results[name];
+        NSDictionary *expected = baselineBenchmarks[name];
+        
+        printf("%-36s %12.1f ns/op %10.2f allocs/op %12.1f B/op", name.UTF8String, [measured[S_TXRX_BENCH_NS_PER_OP] doubleValue], [measured[S_TXRX_BENCH_ALLOCATIONS_PER_OP] doubleValue], [measured[S_TXRX_BENCH_BYTES_ALLOCATED_PER_OP] doubleValue]);
+        if (!expected) {
+            printf("  (no baseline)\n");
+            continue;
+        }
+        printf("\n");
+        
+        for (NSString *key in @[S_TXRX_BENCH_NS_PER_OP, S_TXRX_BENCH_ALLOCATIONS_PER_OP, S_TXRX_BENCH_BYTES_ALLOCATED_PER_OP]) {
+            double value = [measured[key] doubleValue];
+            double limit = [expected[key] doubleValue] * (1.0 + tolerance);
+            
+            if (value > limit) {
+                printf("    REGRESSION %s: %.2f exceeds baseline %.2f by more than %.0f%%\n", key.UTF8String, value, [expected[key] doubleValue], tolerance * 100.0);
+                regressions++;
+            }
+        }
+    }
+    
+    return regressions;
+}
+
+int main(int argc, const char * argv[])
+{
+    @autoreleasepool {
+        NSString *baselinePath = @"bench/baseline.json";
+        bool record = false;
+        NSMutableDictionary *results = [NSMutableDictionary new];
+        NSDictionary *baseline;
+        TxRxManager *manager;
+        
+        for (int i = 1; i < argc; i++) {
+            if (strcmp(argv[i], "--record") == 0)
+                record = true;
+            else if (strcmp(argv[i], "--baseline") == 0 && i + 1 < argc)
+                baselinePath = [NSString stringWithUTF8String: argv[++i]];
+        }
+        
+        baseline = [NSJSONSerialization JSONObjectWithData: [NSData dataWithContentsOfFile: baselinePath] ?: [NSData new] options: 0 error: nil];
+        
+        malloc_logger = txRxBenchMallocLogger;
+        manager = txRxBenchManager();
+        txRxBenchSendDataPiece(manager, results);
+        txRxBenchReceiveAppend(manager, results);
+        txRxBenchTerminatorCheck(manager, results);
+        txRxBenchDeviceLookup(manager, results);
+        txRxBenchPluginCallbacks(manager, results);
+        malloc_logger = NULL;
+        
+        if (record) {
+            NSDictionary *recorded = @{
+                                       @"tolerance": baseline[@"tolerance"] ?: @(TXRX_BENCH_DEFAULT_TOLERANCE),
+                                       @"benchmarks": results
+                                       };
+            NSData *json = [NSJSONSerialization dataWithJSONObject: recorded options: NSJSONWritingPrettyPrinted | NSJSONWritingSortedKeys error: nil];
+            
+            txRxBenchCompare(results, recorded);
+            [json writeToFile: baselinePath atomically: true];
+            printf("Baseline recorded to %s\n", baselinePath.UTF8String);
+            return 0;
+        }
+        
+        if (txRxBenchCompare(results, baseline) != 0)
+            return 1;
+    }
+    
+    return 0;
+}
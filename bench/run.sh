@@ -0,0 +1,18 @@
+#!/bin/sh
+#
+# Builds and runs TxRx benchmarks. Requires macOS with Xcode command line tools.
+#
+# Usage: bench/run.sh [--record]
+#   --record  stores current results as bench/baseline.json instead of comparing against it
+#
+set -e
+cd "$(dirname "$0")/.."
+
+mkdir -p bench/build
+clang -fobjc-arc -O2 -Wall \
+    -framework Foundation -framework CoreBluetooth \
+    -Isrc/ios -Isrc/ios/Library -Ibench/Stubs \
+    src/ios/Library/*.m src/ios/TxrxPlugin.m bench/Stubs/Cordova/CDV.m bench/TxRxBench.m \
+    -o bench/build/txrxbench
+
+exec bench/build/txrxbench --baseline bench/baseline.json "$@"
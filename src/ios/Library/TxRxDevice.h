@@ -30,6 +30,15 @@
 @class TxRxManager;
 @class TxRxWatchDogTimer;
 
+/**
+ TxRxDeviceReconnectPolicy tells TxRxManager what to do with a command in flight when the link to an auto reconnecting device is lost
+ */
+typedef NS_ENUM(uint32_t, TxRxDeviceReconnectPolicy)
+{
+    TERTIUM_RECONNECT_FAIL_PENDING = 0
+    ,TERTIUM_RECONNECT_REPLAY_PENDING
+};
+
 /**
  
  TxRxManager library TxRxDevice class
@@ -78,4 +87,22 @@
  If device is connected
  */
 @property (nonatomic, readonly) bool isConnected;
+
+/**
+ If TxRxManager has to reconnect the device when the link drops without a disconnectDevice call. Reconnection reuses the cached peripheral and device profile, no scan is needed
+ DEFAULT: false
+ */
+@property (nonatomic) bool autoReconnect;
+
+/**
+ What to do with a command in flight when the link drops and autoReconnect is enabled. Refer to TxRxDeviceReconnectPolicy
+ DEFAULT: TERTIUM_RECONNECT_FAIL_PENDING
+ */
+@property (nonatomic) TxRxDeviceReconnectPolicy reconnectPolicy;
+
+/**
+ Maximum number of reconnect attempts before giving up. 0 means retry until disconnectDevice is called
+ DEFAULT: 0
+ */
+@property (nonatomic) NSUInteger maxReconnectAttempts;
 @end
@@ -65,7 +65,7 @@ NSData* _dataToSend;
 
 // Implements hidden TxRxDeviceManagerExchangeProtocol (Below methods are only to be used by TxRxMananger class)
 #pragma mark TxRxDeviceManagerExchangeProtocol hidden protocol implementation
-@synthesize watchDogTimer, sendingData, bytesToSend, bytesSent, totalBytesSent, deviceConnected, dataToSend = _dataToSend, receivedData, deviceProfile;
+@synthesize watchDogTimer, sendingData, bytesToSend, bytesSent, totalBytesSent, deviceConnected, dataToSend = _dataToSend, receivedData, deviceProfile, pendingCommand, reconnectAttempts, restoringSession;
 
 /**
  Implements dataToSend property getter
@@ -126,8 +126,21 @@ NOTE: PROTECTED method (refer to TxRxDeviceManagerExchangeProtocol for details)
     deviceConnected = false;
     _txChar = nil;
     _rxChar = nil;
-    sendingData = false;
     deviceProfile = nil;
+    pendingCommand = nil;
+    reconnectAttempts = 0;
+    restoringSession = false;
+    [self resetTransferStates];
+}
+
+/**
+ Utility method to clear data exchange states only. Characteristics and device profile are kept, so the session may be restored after an automatic reconnect
+ 
+ NOTE: PROTECTED method (refer to TxRxDeviceManagerExchangeProtocol for details)
+ */
+-(void)resetTransferStates
+{
+    sendingData = false;
     [self resetReceivedData];
 }
 
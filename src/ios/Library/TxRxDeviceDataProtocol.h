@@ -82,6 +82,17 @@
  Informs delegate a general error happened on the device
  */
 -(void)deviceInternalError: (TxRxDevice * _Nonnull) device withError: (NSError * _Nonnull) error;
+
+@optional
+/**
+ Informs delegate the link to an auto reconnecting device has been lost and a reconnect attempt has been scheduled
+ */
+-(void)deviceReconnecting: (TxRxDevice * _Nonnull) device;
+
+/**
+ Informs delegate an auto reconnecting device has been reconnected and its session restored. Device is ready to receive commands
+ */
+-(void)deviceReconnected: (TxRxDevice * _Nonnull) device;
 @end
 
 #endif /* TxRxDeviceDataProtocol_h */
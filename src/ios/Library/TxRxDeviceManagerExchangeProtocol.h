@@ -63,11 +63,27 @@
 */
 @property (nonatomic, strong, nonnull) NSMutableData *receivedData;
 
+/**
+ The command passed to the last sendData call, without terminator. Kept until the device answers or fails, so it may be replayed after an automatic reconnect
+*/
+@property (nonatomic, strong, nullable) NSData *pendingCommand;
+
+/**
+ Reconnect attempts made since the link has been lost
+*/
+@property (nonatomic) NSUInteger reconnectAttempts;
+
+/**
+ True while TxRxManager restores the session of a reconnected device, until its characteristics are bound again
+*/
+@property (nonatomic) bool restoringSession;
+
 // Please refer to TxRxDevice implementation for method details
 -(void)scheduleWatchdogWithParameters:(NSInteger) inPhase withInterval:(NSTimeInterval)ti target:(id _Nonnull )aTarget selector:(SEL _Nonnull)aSelector;
 -(void)invalidateWatchDogTimer;
 -(void)resetReceivedData;
 -(void)resetStates;
+-(void)resetTransferStates;
 @end
 
 #endif /* TxRxDeviceExchangeProtocol_h */
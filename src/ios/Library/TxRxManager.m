@@ -80,6 +80,16 @@ double _receivePacketsTimeout;
  */
 double _writePacketTimeout;
 
+/**
+ reconnectBaseDelay - The delay before the first reconnect attempt of an auto reconnecting device. Doubles at each failed attempt
+ */
+double _reconnectBaseDelay;
+
+/**
+ reconnectMaxDelay - The MAXIMUM delay between two reconnect attempts of an auto reconnecting device
+ */
+double _reconnectMaxDelay;
+
 /**
  Mutable array of scannned devices found by startScan. Used for input parameter validation and internal cleanup
  */
@@ -100,6 +110,11 @@ NSMutableArray *_disconnectingDevices;
  */
 NSMutableArray *_connectedDevices;
 
+/**
+ Mutable array of auto reconnecting devices which lost their link. Used for input parameter validation and session restore
+ */
+NSMutableArray *_reconnectingDevices;
+
 /**
  Gets the single instance of the class
  
@@ -158,6 +173,7 @@ NSMutableArray *_connectedDevices;
         _connectingDevices = [NSMutableArray new];
         _connectedDevices = [NSMutableArray new];
         _disconnectingDevices = [NSMutableArray new];
+        _reconnectingDevices = [NSMutableArray new];
         
         // Initialize Ble APIs
         _centralManager = [[CBCentralManager alloc] initWithDelegate:self queue:_dispatchQueue];
@@ -179,13 +195,19 @@ NSMutableArray *_connectedDevices;
             case CBManagerStateResetting:
             case CBManagerStateUnsupported:
             case CBManagerStateUnauthorized:
+                // Cached peripherals are stale after a stack reset or a permission change, sessions can't be restored
+                [self masterCleanUp: false];
+                _blueToothPoweredOn = false;
+                break;
+                
             case CBManagerStatePoweredOff:
-                [self masterCleanUp];
+                [self masterCleanUp: true];
                 _blueToothPoweredOn = false;
                 break;
                 
             case CBManagerStatePoweredOn:
                 _blueToothPoweredOn = true;
+                [self resumeReconnects];
                 break;
         }
     } else {
@@ -311,7 +333,8 @@ NSMutableArray *_connectedDevices;
     }
     
     // Verify we aren't ALREADY connecting to specified device
-    if ([_connectingDevices containsObject: device]) {
+    // NOTE: a rescan creates new instances for the same peripheral, so reconnecting devices are matched by peripheral
+    if ([_connectingDevices containsObject: device] || [self deviceFromPeripheral: device.cbPeripheral inDevices: _reconnectingDevices]) {
         [self sendDeviceConnectError: device withErrorCode: TERTIUM_ERROR_DEVICE_ALREADY_CONNECTING withText: S_TERTIUM_ERROR_DEVICE_ALREADY_CONNECTING];
         return;
     }
@@ -360,6 +383,13 @@ NSMutableArray *_connectedDevices;
 {
     TxRxDevice *device;
     
+    // A failed reconnect attempt is retried after backoff
+    device = [self deviceFromPeripheral: peripheral inDevices: _reconnectingDevices];
+    if (device) {
+        [self scheduleReconnect: device];
+        return;
+    }
+    
     device = [self deviceFromConnectingPeripheral: peripheral];
     if (!device) {
         return;
@@ -381,6 +411,13 @@ NSMutableArray *_connectedDevices;
 {
     TxRxDevice *device;
     
+    // An auto reconnecting device got its link back, restore its session instead of starting a new one
+    device = [self deviceFromPeripheral: peripheral inDevices: _reconnectingDevices];
+    if (device) {
+        [self restoreSession: device];
+        return;
+    }
+    
     // Search for the TxRxDevice class instance by the CoreBlueTooth peripheral instance
     device = [self deviceFromConnectingPeripheral: peripheral];
     if (!device) {
@@ -415,6 +452,7 @@ NSMutableArray *_connectedDevices;
  */
 - (void)peripheral:(CBPeripheral *)peripheral didDiscoverServices:(NSError *)error
 {
+    NSObject<TxRxDeviceManagerExchangeProtocol> *hiddenDevice;
     CBService* tertiumService;
     TxRxDevice* device;
     
@@ -425,7 +463,14 @@ NSMutableArray *_connectedDevices;
         return;
     }
     
+    hiddenDevice = (NSObject<TxRxDeviceManagerExchangeProtocol> *) device;
     if(error != nil) {
+        // While restoring a session the device is simply reconnected again
+        if (hiddenDevice.restoringSession) {
+            [self restoreSessionFailed: device];
+            return;
+        }
+        
         // An error happened discovering services, report to delegate. For us, it's still CONNECT phase
         if (device.delegate)
             dispatch_async(_callbackQueue, ^{
@@ -448,8 +493,13 @@ NSMutableArray *_connectedDevices;
             break;
     }
     
-    if (tertiumService)
-        [peripheral discoverCharacteristics: nil forService:tertiumService];
+    if (tertiumService) {
+        // When restoring a session only Tertium characteristics are needed
+        if (hiddenDevice.restoringSession)
+            [peripheral discoverCharacteristics: @[[CBUUID UUIDWithString: device.deviceProfile.txUUID], [CBUUID UUIDWithString: device.deviceProfile.rxUUID]] forService: tertiumService];
+        else
+            [peripheral discoverCharacteristics: nil forService:tertiumService];
+    }
 }
 
 /**
@@ -458,10 +508,17 @@ NSMutableArray *_connectedDevices;
 - (void)peripheral:(CBPeripheral *)peripheral didDiscoverCharacteristicsForService:(CBService *)service
              error:(NSError *)error
 {
+    NSObject<TxRxDeviceManagerExchangeProtocol> *hiddenDevice;
     TxRxDevice* device;
     
     // Look for Tertium BLE device transmit and receive characteristics
     device = [self deviceFromConnectedPeripheral: peripheral];
+    hiddenDevice = (NSObject<TxRxDeviceManagerExchangeProtocol> *) device;
+    if (error != nil && hiddenDevice.restoringSession) {
+        [self restoreSessionFailed: device];
+        return;
+    }
+    
     for (CBCharacteristic *characteristic in service.characteristics) {
         if (device.deviceProfile) {
             if([characteristic.UUID isEqual:[CBUUID UUIDWithString:device.deviceProfile.txUUID]]) {
@@ -475,10 +532,14 @@ NSMutableArray *_connectedDevices;
         NSLog(@"Discovered characteristic %@ of service %@ of device %@ option mask %08lx", [characteristic.UUID UUIDString], [service.UUID UUIDString], device.Name, (long)characteristic.properties);
     }
     
-    if (device.rxChar != nil && device.txChar != nil && device.delegate) {
-        dispatch_async(_callbackQueue, ^{
-            [device.delegate deviceReady: device];
-        });
+    if (device.rxChar != nil && device.txChar != nil) {
+        if (hiddenDevice.restoringSession) {
+            [self sessionRestored: device];
+        } else if (device.delegate) {
+            dispatch_async(_callbackQueue, ^{
+                [device.delegate deviceReady: device];
+            });
+        }
     }
 }
 
@@ -513,6 +574,16 @@ NSMutableArray *_connectedDevices;
         return;
     }
     
+    // While reconnecting or restoring the session a command is kept for replay, if device reconnect policy allows it. Otherwise it is refused below
+    if (device.reconnectPolicy == TERTIUM_RECONNECT_REPLAY_PENDING && ([_reconnectingDevices containsObject: device] || hiddenDevice.restoringSession)) {
+        if (hiddenDevice.pendingCommand != nil) {
+            [self sendDeviceWriteError: device withErrorCode: TERTIUM_ERROR_DEVICE_SENDING_DATA_ALREADY withText: S_TERTIUM_ERROR_DEVICE_SENDING_DATA_ALREADY];
+        } else {
+            hiddenDevice.pendingCommand = data;
+        }
+        return;
+    }
+    
     if ([_connectedDevices containsObject: device] == false) {
         [self sendNotConnectedError: device];
         return;
@@ -535,6 +606,7 @@ NSMutableArray *_connectedDevices;
     [dataToSend appendData: data];
     [dataToSend appendData: [device.deviceProfile.commandEnd dataUsingEncoding: NSASCIIStringEncoding]];
     hiddenDevice.dataToSend = dataToSend;
+    hiddenDevice.pendingCommand = data;
     hiddenDevice.sendingData = true;
 
     // Commence data sending to device. NOTE: Data is sent in maxSendPacketSize fragments (refer to TxRxDeviceProfile class for details)
@@ -554,8 +626,8 @@ NSMutableArray *_connectedDevices;
     NSData *packet;
     NSInteger packetSize;
     
+    hiddenDevice = (NSObject<TxRxDeviceManagerExchangeProtocol> *) device;
     if ([_connectedDevices containsObject: device]) {
-        hiddenDevice = (NSObject<TxRxDeviceManagerExchangeProtocol> *) device;
         if (!hiddenDevice.sendingData)
             return;
         
@@ -579,6 +651,7 @@ NSMutableArray *_connectedDevices;
             return;
         }
     } else {
+        hiddenDevice.pendingCommand = nil;
         [self sendDeviceWriteError: device withErrorCode: TERTIUM_ERROR_DEVICE_NOT_CONNECTED withText: S_TERTIUM_ERROR_DEVICE_NOT_CONNECTED];
     }
 }
@@ -591,7 +664,9 @@ NSMutableArray *_connectedDevices;
 -(void)watchDogTimerTickReceivingSendAck:(TxRxWatchDogTimer *) timer ManagesDevice: (TxRxDevice *) device inPhase: (NSNumber *) phase
 {
     NSObject<TxRxDeviceManagerExchangeProtocol> *hiddenDevice;
+    hiddenDevice = (NSObject<TxRxDeviceManagerExchangeProtocol> *) device;
     hiddenDevice.sendingData = false;
+    hiddenDevice.pendingCommand = nil;
     [self sendDeviceWriteError: device withErrorCode: TERTIUM_ERROR_DEVICE_SENDING_DATA_TIMEOUT withText: S_TERTIUM_ERROR_DEVICE_SENDING_DATA_TIMEOUT];
 }
 
@@ -609,6 +684,7 @@ NSMutableArray *_connectedDevices;
     hiddenDevice = (NSObject<TxRxDeviceManagerExchangeProtocol> *) device;
     if(error != nil) {
         hiddenDevice.sendingData = false;
+        hiddenDevice.pendingCommand = nil;
         if (device.delegate)
             dispatch_async(_callbackQueue, ^{
                 [device.delegate deviceWriteError: device withError: error];
@@ -639,6 +715,9 @@ NSMutableArray *_connectedDevices;
     // Verify what we have received
     NSString *text;
     
+    // The command has either been answered or failed, it won't be replayed anymore
+    hiddenDevice.pendingCommand = nil;
+    
     // Verify terminator is ok, otherwise we may haven't received a whole response command
     text = [[NSString alloc] initWithData: hiddenDevice.receivedData encoding: NSASCIIStringEncoding];
     if ([self isTerminatorOK: device forText: text]) {
@@ -711,6 +790,12 @@ NSMutableArray *_connectedDevices;
 {
     NSObject<TxRxDeviceManagerExchangeProtocol> *hiddenDevice;
 
+    // Disconnecting a device which lost its link stops reconnect attempts. It has no link, so it is allowed with bluetooth off or while scanning
+    if ([_reconnectingDevices containsObject: device]) {
+        [self abandonReconnect: device];
+        return;
+    }
+    
     // Verify BlueTooth is powered on
     if (!_blueToothPoweredOn) {
         [self sendBlueToothNotReadyOrLost];
@@ -760,6 +845,7 @@ NSMutableArray *_connectedDevices;
     [_connectingDevices removeObject: device];
     
     //
+    [self failPendingCommand: device];
     [hiddenDevice resetStates];
 
     // Inform delegate device disconnet timed out
@@ -776,6 +862,19 @@ NSMutableArray *_connectedDevices;
     NSObject<TxRxDeviceManagerExchangeProtocol> *hiddenDevice;
     TxRxDevice* device;
     
+    // A cancelled reconnect attempt. Backoff timer is already handling the device
+    if ([self deviceFromPeripheral: peripheral inDevices: _reconnectingDevices])
+        return;
+    
+    // Link dropped without a disconnectDevice call
+    if (![self deviceFromPeripheral: peripheral inDevices: _disconnectingDevices]) {
+        // NOTE: an attempt cancelled by abandonReconnect lands here too, its device is already gone so nothing is reported
+        device = [self deviceFromPeripheral: peripheral inDevices: _connectedDevices];
+        if (device)
+            [self deviceLinkLost: device withError: error];
+        return;
+    }
+    
     device = [self deviceFromDisconnectingPeripheral: peripheral];
     if (device) {
         hiddenDevice = (NSObject<TxRxDeviceManagerExchangeProtocol> *) device;
@@ -791,6 +890,7 @@ NSMutableArray *_connectedDevices;
         
         // Remove device from internal validation arrays and inform delegate of the disconnection
         [hiddenDevice invalidateWatchDogTimer];
+        [self failPendingCommand: device];
         [hiddenDevice resetStates];
         
         [_connectedDevices removeObject: device];
@@ -804,6 +904,294 @@ NSMutableArray *_connectedDevices;
     }
 }
 
+#pragma mark TxRxManager auto reconnect implementation
+
+/**
+ Handles the loss of the link to a connected device
+ 
+ Devices without autoReconnect are cleaned up and reported as disconnected. Auto reconnecting devices keep their session and a reconnect attempt is scheduled
+ 
+ @param device - The device which lost its link
+ @param error - The error reported by CoreBluetooth, may be nil. Not reported to delegate, a dropped link is not a connect error
+ */
+-(void)deviceLinkLost: (TxRxDevice *_Nonnull) device withError: (NSError *_Nullable) error
+{
+    NSObject<TxRxDeviceManagerExchangeProtocol> *hiddenDevice;
+    
+    hiddenDevice = (NSObject<TxRxDeviceManagerExchangeProtocol> *) device;
+    
+    // Link dropped again while restoring the session, this is a failed attempt, not a new reconnect
+    if (device.autoReconnect && hiddenDevice.restoringSession) {
+        [self restoreSessionFailed: device];
+        return;
+    }
+    
+    [_connectedDevices removeObject: device];
+    [_connectingDevices removeObject: device];
+    
+    if (!device.autoReconnect) {
+        [hiddenDevice invalidateWatchDogTimer];
+        [self failPendingCommand: device];
+        [hiddenDevice resetStates];
+        
+        if (device.delegate)
+            dispatch_async(_callbackQueue, ^{
+                [device.delegate deviceDisconnected: device];
+            });
+        return;
+    }
+    
+    [self parkForReconnect: device];
+    [self scheduleReconnect: device];
+}
+
+/**
+ Moves a device to the reconnecting devices array keeping its peripheral and device profile
+ 
+ NOTE: The pending command is kept only if device reconnect policy is TERTIUM_RECONNECT_REPLAY_PENDING, otherwise it fails immediately
+ NOTE: A device parked while restoring its session keeps its attempts count and delegate isn't informed again
+ 
+ @param device - The device to park
+ */
+-(void)parkForReconnect: (TxRxDevice *_Nonnull) device
+{
+    NSObject<TxRxDeviceManagerExchangeProtocol> *hiddenDevice;
+    bool freshPark;
+    
+    hiddenDevice = (NSObject<TxRxDeviceManagerExchangeProtocol> *) device;
+    freshPark = !hiddenDevice.restoringSession;
+    [hiddenDevice invalidateWatchDogTimer];
+    [hiddenDevice resetTransferStates];
+    hiddenDevice.deviceConnected = false;
+    hiddenDevice.restoringSession = false;
+    if (freshPark)
+        hiddenDevice.reconnectAttempts = 0;
+    
+    if (device.reconnectPolicy != TERTIUM_RECONNECT_REPLAY_PENDING)
+        [self failPendingCommand: device];
+    
+    if (![_reconnectingDevices containsObject: device])
+        [_reconnectingDevices addObject: device];
+    
+    // Keeps deviceWithIndexedName resolving the device, so the application can still disconnect it or send it commands to replay
+    if (![_scannedDevices containsObject: device])
+        [_scannedDevices addObject: device];
+    
+    if (freshPark && [device.delegate respondsToSelector: @selector(deviceReconnecting:)])
+        dispatch_async(_callbackQueue, ^{
+            [device.delegate deviceReconnecting: device];
+        });
+}
+
+/**
+ Schedules the next reconnect attempt of a device
+ 
+ Delay grows exponentially from reconnectBaseDelay up to reconnectMaxDelay. Half of it is randomized so several readers dropping together don't retry in lockstep
+ 
+ @param device - The device to reconnect
+ */
+-(void)scheduleReconnect: (TxRxDevice *_Nonnull) device
+{
+    NSObject<TxRxDeviceManagerExchangeProtocol> *hiddenDevice;
+    double delay;
+    
+    hiddenDevice = (NSObject<TxRxDeviceManagerExchangeProtocol> *) device;
+    if (device.maxReconnectAttempts != 0 && hiddenDevice.reconnectAttempts >= device.maxReconnectAttempts) {
+        [self sendDeviceConnectError: device withErrorCode: TERTIUM_ERROR_DEVICE_RECONNECT_FAILED withText: S_TERTIUM_ERROR_DEVICE_RECONNECT_FAILED];
+        [self abandonReconnect: device];
+        return;
+    }
+    
+    delay = MIN(_reconnectMaxDelay, _reconnectBaseDelay * pow(2.0, MIN(hiddenDevice.reconnectAttempts, (NSUInteger) 16)));
+    delay = delay / 2.0 + delay / 2.0 * arc4random_uniform(1001) / 1000.0;
+    
+    [hiddenDevice scheduleWatchdogWithParameters: TERTIUM_PHASE_RECONNECTING withInterval: delay target: self selector: @selector(watchDogTimerForReconnectTick:ManagesDevice:inPhase:)];
+}
+
+/**
+ Backoff delay elapsed, tries to connect the cached peripheral again. No scan is needed
+ */
+-(void)watchDogTimerForReconnectTick:(TxRxWatchDogTimer *) timer ManagesDevice: (TxRxDevice *) device inPhase: (NSNumber *) phase
+{
+    NSObject<TxRxDeviceManagerExchangeProtocol> *hiddenDevice;
+    
+    if (![_reconnectingDevices containsObject: device])
+        return;
+    
+    // Attempts are resumed by centralManagerDidUpdateState when bluetooth is back
+    if (!_blueToothPoweredOn)
+        return;
+    
+    hiddenDevice = (NSObject<TxRxDeviceManagerExchangeProtocol> *) device;
+    [hiddenDevice scheduleWatchdogWithParameters: TERTIUM_PHASE_RECONNECTING withInterval: _connectTimeout target: self selector: @selector(watchDogTimerForReconnectTimeoutTick:ManagesDevice:inPhase:)];
+    [_centralManager connectPeripheral: device.cbPeripheral options: nil];
+    hiddenDevice.reconnectAttempts++;
+}
+
+/**
+ A reconnect attempt timed out, cancels it and schedules the next one
+ */
+-(void)watchDogTimerForReconnectTimeoutTick:(TxRxWatchDogTimer *) timer ManagesDevice: (TxRxDevice *) device inPhase: (NSNumber *) phase
+{
+    [_centralManager cancelPeripheralConnection: device.cbPeripheral];
+    [self scheduleReconnect: device];
+}
+
+/**
+ Restores the session of a reconnected device
+ 
+ Cached device profile is used to discover only Tertium service and characteristics. Notifications on txChar are enabled again by didDiscoverCharacteristicsForService
+ 
+ @param device - The reconnected device
+ */
+-(void)restoreSession: (TxRxDevice *_Nonnull) device
+{
+    NSObject<TxRxDeviceManagerExchangeProtocol> *hiddenDevice;
+    
+    hiddenDevice = (NSObject<TxRxDeviceManagerExchangeProtocol> *) device;
+    [hiddenDevice invalidateWatchDogTimer];
+    hiddenDevice.deviceConnected = true;
+    hiddenDevice.restoringSession = true;
+    
+    [_reconnectingDevices removeObject: device];
+    [_connectedDevices addObject: device];
+    
+    // Discovery has to complete in time, otherwise the device is reconnected again
+    [hiddenDevice scheduleWatchdogWithParameters: TERTIUM_PHASE_CONNECTING withInterval: _connectTimeout target: self selector: @selector(watchDogTimerForRestoreSessionTick:ManagesDevice:inPhase:)];
+    
+    // Characteristics of the dropped link are stale, bind the new ones
+    device.cbPeripheral.delegate = self;
+    device.txChar = nil;
+    device.rxChar = nil;
+    
+    // Link may have dropped before the device was identified, in this case a full discovery is needed
+    if (device.deviceProfile)
+        [device.cbPeripheral discoverServices: @[[CBUUID UUIDWithString: device.deviceProfile.serviceUUID]]];
+    else
+        [device.cbPeripheral discoverServices: nil];
+}
+
+/**
+ Session restore of a reconnected device didn't complete in time
+ */
+-(void)watchDogTimerForRestoreSessionTick:(TxRxWatchDogTimer *) timer ManagesDevice: (TxRxDevice *) device inPhase: (NSNumber *) phase
+{
+    NSObject<TxRxDeviceManagerExchangeProtocol> *hiddenDevice;
+    
+    hiddenDevice = (NSObject<TxRxDeviceManagerExchangeProtocol> *) device;
+    if (hiddenDevice.restoringSession)
+        [self restoreSessionFailed: device];
+}
+
+/**
+ Session restore of a reconnected device failed. Drops the link and schedules the next reconnect attempt
+ 
+ NOTE: Pending command is kept, it is replayed or failed when reconnect succeeds or is abandoned
+ 
+ @param device - The device being restored
+ */
+-(void)restoreSessionFailed: (TxRxDevice *_Nonnull) device
+{
+    NSObject<TxRxDeviceManagerExchangeProtocol> *hiddenDevice;
+    
+    hiddenDevice = (NSObject<TxRxDeviceManagerExchangeProtocol> *) device;
+    [hiddenDevice invalidateWatchDogTimer];
+    hiddenDevice.restoringSession = false;
+    hiddenDevice.deviceConnected = false;
+    
+    // Device is moved back first, so the disconnection caused by the cancel is ignored
+    [_connectedDevices removeObject: device];
+    [_reconnectingDevices addObject: device];
+    [_centralManager cancelPeripheralConnection: device.cbPeripheral];
+    
+    [self scheduleReconnect: device];
+}
+
+/**
+ Session of a reconnected device has been restored. Informs delegate and replays the pending command, if any
+ 
+ @param device - The restored device
+ */
+-(void)sessionRestored: (TxRxDevice *_Nonnull) device
+{
+    NSObject<TxRxDeviceManagerExchangeProtocol> *hiddenDevice;
+    NSData *pendingCommand;
+    
+    hiddenDevice = (NSObject<TxRxDeviceManagerExchangeProtocol> *) device;
+    [hiddenDevice invalidateWatchDogTimer];
+    hiddenDevice.restoringSession = false;
+    hiddenDevice.reconnectAttempts = 0;
+    
+    if ([device.delegate respondsToSelector: @selector(deviceReconnected:)])
+        dispatch_async(_callbackQueue, ^{
+            [device.delegate deviceReconnected: device];
+        });
+    
+    pendingCommand = hiddenDevice.pendingCommand;
+    if (pendingCommand == nil)
+        return;
+    
+    hiddenDevice.pendingCommand = nil;
+    
+    // sendData refuses to send while scanning, fail the replay as a write so the application knows the command is lost
+    if (_isScanning) {
+        [self sendDeviceWriteError: device withErrorCode: TERTIUM_ERROR_DEVICE_UNABLE_TO_PERFORM_DURING_SCAN withText: S_TERTIUM_ERROR_DEVICE_UNABLE_TO_PERFORM_DURING_SCAN];
+        return;
+    }
+    
+    [self sendData: device withData: pendingCommand];
+}
+
+/**
+ Stops reconnecting a device. Pending command fails and delegate is informed the device is disconnected
+ 
+ @param device - The reconnecting device
+ */
+-(void)abandonReconnect: (TxRxDevice *_Nonnull) device
+{
+    NSObject<TxRxDeviceManagerExchangeProtocol> *hiddenDevice;
+    
+    hiddenDevice = (NSObject<TxRxDeviceManagerExchangeProtocol> *) device;
+    [hiddenDevice invalidateWatchDogTimer];
+    [_centralManager cancelPeripheralConnection: device.cbPeripheral];
+    [_reconnectingDevices removeObject: device];
+    [self failPendingCommand: device];
+    [hiddenDevice resetStates];
+    
+    if (device.delegate)
+        dispatch_async(_callbackQueue, ^{
+            [device.delegate deviceDisconnected: device];
+        });
+}
+
+/**
+ Fails the command a device is sending or holding for replay, if any, with a connection lost error
+ 
+ @param device - The device whose link is gone
+ */
+-(void)failPendingCommand: (TxRxDevice *_Nonnull) device
+{
+    NSObject<TxRxDeviceManagerExchangeProtocol> *hiddenDevice;
+    
+    hiddenDevice = (NSObject<TxRxDeviceManagerExchangeProtocol> *) device;
+    if (hiddenDevice.pendingCommand == nil)
+        return;
+    
+    hiddenDevice.pendingCommand = nil;
+    [self sendDeviceWriteError: device withErrorCode: TERTIUM_ERROR_DEVICE_CONNECTION_LOST withText: S_TERTIUM_ERROR_DEVICE_CONNECTION_LOST];
+}
+
+/**
+ Schedules reconnect attempts of every reconnecting device. Called when bluetooth is powered on again
+ */
+-(void)resumeReconnects
+{
+    // scheduleReconnect may abandon a device and remove it from the array, iterate over a copy
+    for (TxRxDevice *device in [_reconnectingDevices copy]) {
+        [self scheduleReconnect: device];
+    }
+}
+
 #pragma mark TxRxManager implementation
 
 -(bool)isTerminatorOK: (TxRxDevice *_Nonnull) device forText: (NSString *_Nonnull) text
@@ -817,6 +1205,17 @@ NSMutableArray *_connectedDevices;
 /*
  Methods for finding a TxRxDevice from a CoreBlueTooth CBPeripheral instance
  */
+-(TxRxDevice *) deviceFromPeripheral: (CBPeripheral*_Nonnull) peripheral inDevices: (NSArray *_Nonnull) devices
+{
+    for (TxRxDevice* device in devices) {
+        if (device.cbPeripheral == peripheral) {
+            return device;
+        }
+    }
+    
+    return nil;
+}
+
 -(TxRxDevice *) deviceFromConnectingPeripheral: (CBPeripheral*_Nonnull) peripheral
 {
     for (TxRxDevice* device in _connectingDevices) {
@@ -856,28 +1255,63 @@ NSMutableArray *_connectedDevices;
 
 /**
  Clears every internal array. May be called on Bluetooth hardware reset
+ 
+ @param keepSessions - true if auto reconnecting devices have to be restored when bluetooth is back, false to abandon their reconnection
  */
--(void)masterCleanUp
+-(void)masterCleanUp: (bool) keepSessions
 {
+    if (keepSessions) {
+        // Auto reconnecting devices keep their session, it will be restored when bluetooth is back. Devices being disconnected by the application are not
+        for (TxRxDevice *device in [_connectedDevices copy]) {
+            if (device.autoReconnect && ![_disconnectingDevices containsObject: device]) {
+                [_connectedDevices removeObject: device];
+                [self parkForReconnect: device];
+            }
+        }
+        
+        for (NSObject<TxRxDeviceManagerExchangeProtocol> *device in _reconnectingDevices) {
+            [device invalidateWatchDogTimer];
+        }
+    } else {
+        for (TxRxDevice *device in [_reconnectingDevices copy]) {
+            [self abandonReconnect: device];
+        }
+    }
+    
     for (NSObject<TxRxDeviceManagerExchangeProtocol> *device in _scannedDevices) {
+        if ([_reconnectingDevices containsObject: device])
+            continue;
+        
         [device invalidateWatchDogTimer];
         [device resetStates];
     }
     [_scannedDevices removeAllObjects];
     
+    // Reconnecting devices stay resolvable by deviceWithIndexedName, see parkForReconnect
+    [_scannedDevices addObjectsFromArray: _reconnectingDevices];
+    
     for (NSObject<TxRxDeviceManagerExchangeProtocol> *device in _connectingDevices) {
+        if ([_reconnectingDevices containsObject: device])
+            continue;
+        
         [device invalidateWatchDogTimer];
         [device resetStates];
     }
     [_connectingDevices removeAllObjects];
     
     for (NSObject<TxRxDeviceManagerExchangeProtocol> *device in _connectedDevices) {
+        if ([_reconnectingDevices containsObject: device])
+            continue;
+        
         [device invalidateWatchDogTimer];
         [device resetStates];
     }
     [_connectedDevices removeAllObjects];
     
     for (NSObject<TxRxDeviceManagerExchangeProtocol> *device in _disconnectingDevices) {
+        if ([_reconnectingDevices containsObject: device])
+            continue;
+        
         [device invalidateWatchDogTimer];
         [device resetStates];
     }
@@ -1011,6 +1445,8 @@ NSMutableArray *_connectedDevices;
     _receiveFirstPacketTimeout = 2.0;
     _receivePacketsTimeout = 0.5;
     _writePacketTimeout = 0.5;
+    _reconnectBaseDelay = 0.25;
+    _reconnectMaxDelay = 8.0;
 }
 
 /**
@@ -1027,6 +1463,10 @@ NSMutableArray *_connectedDevices;
         return _receivePacketsTimeout * 1000.0;
     } else if ([timeOutType caseInsensitiveCompare: S_TERTIUM_TIMEOUT_SEND_PACKET] == NSOrderedSame) {
         return _writePacketTimeout * 1000.0;
+    } else if ([timeOutType caseInsensitiveCompare: S_TERTIUM_TIMEOUT_RECONNECT_BASE_DELAY] == NSOrderedSame) {
+        return _reconnectBaseDelay * 1000.0;
+    } else if ([timeOutType caseInsensitiveCompare: S_TERTIUM_TIMEOUT_RECONNECT_MAX_DELAY] == NSOrderedSame) {
+        return _reconnectMaxDelay * 1000.0;
     } else {
         return 0;
     }
@@ -1047,6 +1487,10 @@ NSMutableArray *_connectedDevices;
         _receivePacketsTimeout = timeOutValue / 1000.0;
     } else if ([timeOutType caseInsensitiveCompare: S_TERTIUM_TIMEOUT_SEND_PACKET] == NSOrderedSame) {
         _writePacketTimeout = timeOutValue / 1000.0;
+    } else if ([timeOutType caseInsensitiveCompare: S_TERTIUM_TIMEOUT_RECONNECT_BASE_DELAY] == NSOrderedSame) {
+        _reconnectBaseDelay = timeOutValue / 1000.0;
+    } else if ([timeOutType caseInsensitiveCompare: S_TERTIUM_TIMEOUT_RECONNECT_MAX_DELAY] == NSOrderedSame) {
+        _reconnectMaxDelay = timeOutValue / 1000.0;
     }
 }
 
@@ -55,6 +55,8 @@ typedef NS_ENUM(uint32_t, TxMRxManagerErrors)
     ,TERTIUM_ERROR_DEVICE_RECEIVING_DATA_TIMEOUT
     ,TERTIUM_ERROR_DEVICE_NOT_FOUND
     ,TERTIUM_INTERNAL_ERROR
+    ,TERTIUM_ERROR_DEVICE_CONNECTION_LOST
+    ,TERTIUM_ERROR_DEVICE_RECONNECT_FAILED
 };
 
 #define TERTIUM_TXRX_ERROR_DOMAIN @"Tertium TxRx BLE device library"
@@ -77,4 +79,6 @@ typedef NS_ENUM(uint32_t, TxMRxManagerErrors)
 #define S_TERTIUM_ERROR_DEVICE_RECEIVING_DATA_TIMEOUT @"Error, timeout while receiving data!"
 #define S_TERTIUM_ERROR_DEVICE_NOT_FOUND @"Device not found in internal data structures!"
 #define S_TERTIUM_ERROR_INTERNAL_ERROR @"Unspecified internal error!"
+#define S_TERTIUM_ERROR_DEVICE_CONNECTION_LOST @"Error, connection to device lost, pending command aborted!"
+#define S_TERTIUM_ERROR_DEVICE_RECONNECT_FAILED @"Error, unable to reconnect to device!"
 #endif /* TxRxManagerErrors_h */
@@ -40,6 +40,7 @@ typedef NS_ENUM(uint32_t, TxRxDevicePhases)
     ,TERTIUM_PHASE_SENDING_DATA
     ,TERTIUM_PHASE_WAITING_SEND_ACK
     ,TERTIUM_PHASE_RECEIVING_DATA
+    ,TERTIUM_PHASE_RECONNECTING
 };
 
 #endif /* TxRxManagerPhases_h */
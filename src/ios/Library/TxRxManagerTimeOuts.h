@@ -36,5 +36,7 @@
 #define S_TERITUM_TIMEOUT_RECEIVE_FIRST_PACKET @"tmReceiveFirstPacket"
 #define S_TERTIUM_TIMEOUT_RECEIVE_PACKETS @"tmReceivePackets"
 #define S_TERTIUM_TIMEOUT_SEND_PACKET @"tmSendPackets"
+#define S_TERTIUM_TIMEOUT_RECONNECT_BASE_DELAY @"tmReconnectBaseDelay"
+#define S_TERTIUM_TIMEOUT_RECONNECT_MAX_DELAY @"tmReconnectMaxDelay"
 
 #endif /* TxRxManagerTimeOuts_h */
@@ -25,14 +25,14 @@
 #import "TxRxWatchDogTimer.h"
 #import "TxRxDevice.h"
 
-@implementation TxRxWatchDogTimer
+@implementation TxRxWatchDogTimer {
+    // Private instance attributes, NOT to be exposed to public
+    NSTimer *_timer;
+    id _target;
+    SEL _selector;
+}
 @synthesize device, interval, phase;
 
-// Private class attributes, NOT to be exposed to public
-NSTimer *_timer;
-id _target;
-SEL _selector;
-
 /**
  Creates a NSTimer with specified parameters including TxRxDevice reference and operational phase (purpose of the watchdog timer)
  
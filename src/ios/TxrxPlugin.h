@@ -9,6 +9,9 @@
     NSMutableDictionary *_jsCallbacks;
     TxRxManager* _manager;
     TxRxDevice* _connectedDevice;
+    bool _autoReconnect;
+    TxRxDeviceReconnectPolicy _reconnectPolicy;
+    NSUInteger _maxReconnectAttempts;
 }
 
 /* COMMANDS */
@@ -20,6 +23,7 @@
 - (void) setTimeouts:(CDVInvokedUrlCommand*) command;
 - (void) setDefaultTimeouts:(CDVInvokedUrlCommand*) command;
 - (void) isDeviceConnected:(CDVInvokedUrlCommand*) command;
+- (void) setAutoReconnect:(CDVInvokedUrlCommand*) command;
 - (void) registerCallback:(CDVInvokedUrlCommand*) command;
 
 @end
@@ -25,6 +25,9 @@
     _manager = [TxRxManager getManager];
     _manager.delegate = self;
     _connectedDevice = nil;
+    _autoReconnect = false;
+    _reconnectPolicy = TERTIUM_RECONNECT_FAIL_PENDING;
+    _maxReconnectAttempts = 0;
 }
 
 -(void) dealloc
@@ -73,6 +76,7 @@
             if ([_manager isScanning]) {
                 [_manager stopScan];
             }
+            [self applyReconnectSettings: device];
             [_manager connectDevice: device];
             _connectedDevice = device;
             
@@ -209,6 +213,36 @@
     [self.commandDelegate sendPluginResult:pluginResult callbackId:command.callbackId];
 }
 
+/**
+ setAutoReconnect - Enable or disable automatic reconnect of the connected device and of the devices connected later
+ @param command - Cordova command, contains arguments
+ */
+- (void) setAutoReconnect:(CDVInvokedUrlCommand*) command
+{
+    DLog(@"TxrxPlugin.setAutoReconnect");
+    CDVPluginResult* pluginResult = nil;
+    NSNumber* enabled = [command.arguments objectAtIndex:0];
+    NSNumber* replayPending = [command.arguments objectAtIndex:1];
+    NSNumber* maxAttempts = [command.arguments objectAtIndex:2];
+    
+    if ([maxAttempts isKindOfClass:[NSNumber class]] && [maxAttempts longLongValue] < 0) {
+        pluginResult = [CDVPluginResult resultWithStatus:CDVCommandStatus_ERROR messageAsString:@"maxAttempts must not be negative"];
+        [self.commandDelegate sendPluginResult:pluginResult callbackId:command.callbackId];
+        return;
+    }
+    
+    _autoReconnect = [enabled isKindOfClass:[NSNumber class]] && [enabled boolValue];
+    _reconnectPolicy = ([replayPending isKindOfClass:[NSNumber class]] && [replayPending boolValue]) ? TERTIUM_RECONNECT_REPLAY_PENDING : TERTIUM_RECONNECT_FAIL_PENDING;
+    _maxReconnectAttempts = [maxAttempts isKindOfClass:[NSNumber class]] ? [maxAttempts unsignedIntegerValue] : 0;
+    
+    if (_connectedDevice != nil) {
+        [self applyReconnectSettings: _connectedDevice];
+    }
+    
+    pluginResult = [CDVPluginResult resultWithStatus:CDVCommandStatus_OK];
+    [self.commandDelegate sendPluginResult:pluginResult callbackId:command.callbackId];
+}
+
 /**
  registerCallback - Register a JavaScript callback
  @param command - Cordova command, contains arguments
@@ -226,6 +260,17 @@
 //                  UTILITIES
 ///////////////////////////////////////////////////
 
+/**
+ applyReconnectSettings - Copies the auto reconnect settings to a device
+ @param device - The device to configure
+ */
+- (void) applyReconnectSettings:(TxRxDevice*) device
+{
+    device.autoReconnect = _autoReconnect;
+    device.reconnectPolicy = _reconnectPolicy;
+    device.maxReconnectAttempts = _maxReconnectAttempts;
+}
+
 /**
  callJsCallback - Invokes a registered JavaScript callback
  @param callbackName - Name of the js callback to call
@@ -477,6 +522,32 @@
     DLog(@"TxrxPlugin.deviceInternalError: %@", error.localizedDescription);
 }
 
+/**
+ Receives information the link to the device has been lost and the device is being reconnected, and dispatches it to the whole application
+ 
+ @param device - The TxRxDevice instance of the reconnecting device
+ */
+-(void)deviceReconnecting: (TxRxDevice *_Nonnull) device
+{
+    DLog(@"TxrxPlugin.deviceReconnecting");
+    NSString* indexedName = [_manager getDeviceIndexedName:device];
+    NSDictionary * msg =@{@"name": [device Name], @"address": indexedName};
+    [self callJsCallback:@"onDeviceReconnecting" msgAsDictionary:msg];
+}
+
+/**
+ Receives information the device has been reconnected and is ready to receive commands again, and dispatches it to the whole application
+ 
+ @param device - The TxRxDevice instance of the reconnected device
+ */
+-(void)deviceReconnected: (TxRxDevice *_Nonnull) device
+{
+    DLog(@"TxrxPlugin.deviceReconnected");
+    NSString* indexedName = [_manager getDeviceIndexedName:device];
+    NSDictionary * msg =@{@"name": [device Name], @"address": indexedName};
+    [self callJsCallback:@"onDeviceReconnected" msgAsDictionary:msg];
+}
+
 
 
 @end
@@ -98,6 +98,18 @@ var txrx = {
     },
 
 
+    /**
+     * Enable or disable automatic reconnect when the link to the connected device is lost (iOS only)
+     * @param {boolean} enabled True to reconnect automatically
+     * @param {boolean} replayPending True to send again the command in flight once reconnected, false to fail it immediately
+     * @param {number} maxAttempts Maximum number of reconnect attempts, 0 to retry until disconnect is called. Negative values are rejected
+     * @param {function} successCallback Success callback
+     * @param {function} errorCallback Error callback
+     */
+    setAutoReconnect: function (enabled, replayPending, maxAttempts, successCallback, errorCallback) {
+        exec(successCallback, errorCallback, "TxrxPlugin", "setAutoReconnect", [enabled, replayPending, maxAttempts]);
+    },
+
     /**
      * Register a callback
      * @param {string} name Name of the callback